@@ -204,6 +204,76 @@ auto fast_hypot(T x, T y) {
 	return (15 * max_val + 7 * min_val) >> 4;
 }
 
+// Velocity profiles: cumulative time fraction as a function of progress toward target
+enum class VelocityProfile : unsigned char {
+	Linear,          // original timing: remaining time split by step_distance / distance_to_target
+	MinimumJerk,     // symmetric bell: x(t) = 10t^3 - 15t^4 + 6t^5
+	AsymmetricFitts  // fast acceleration, long approach: x(t) = 6t^2 - 8t^3 + 3t^4 (peak speed at t = 1/3)
+};
+
+constexpr unsigned char profileTableShift = 6;                       // 64 progress intervals
+constexpr unsigned char profileTableSize = (1 << profileTableShift) + 1;
+constexpr unsigned char profileTimeShift = 15;                        // Q15 time fraction, 32768 == full duration
+constexpr unsigned char profileFloorShift = 2;                        // 1/4 of duration kept for per-step floor (wind, backtracking)
+
+// t(p) = inverse of x(t) at p = i / 64, found by bisection on [0, 1], stored as round(t * 32768)
+constexpr unsigned short minimum_jerk_time_table[profileTableSize] = {
+	0, 4057, 5212, 6054, 6745, 7344, 7881, 8371,
+	8827, 9255, 9660, 10046, 10416, 10772, 11117, 11452,
+	11778, 12096, 12408, 12713, 13013, 13309, 13600, 13888,
+	14173, 14455, 14734, 15012, 15288, 15563, 15837, 16111,
+	16384, 16657, 16931, 17205, 17480, 17756, 18034, 18313,
+	18595, 18880, 19168, 19459, 19755, 20055, 20360, 20672,
+	20990, 21316, 21651, 21996, 22352, 22722, 23108, 23513,
+	23941, 24397, 24887, 25424, 26023, 26714, 27556, 28711,
+	32768
+};
+
+constexpr unsigned short asymmetric_fitts_time_table[profileTableSize] = {
+	0, 1733, 2491, 3090, 3608, 4075, 4507, 4912,
+	5296, 5664, 6018, 6362, 6696, 7022, 7341, 7655,
+	7963, 8268, 8569, 8866, 9161, 9454, 9746, 10036,
+	10325, 10613, 10901, 11189, 11478, 11767, 12056, 12347,
+	12640, 12934, 13230, 13528, 13829, 14134, 14441, 14753,
+	15068, 15389, 15715, 16046, 16384, 16729, 17082, 17444,
+	17815, 18198, 18593, 19002, 19427, 19871, 20337, 20828,
+	21350, 21910, 22516, 23184, 23935, 24809, 25884, 27376,
+	32768
+};
+
+/**
+ * @brief Time (from movement start) at which a table profile reaches given progress, integer only, O(1)
+ *
+ * @param profile Table velocity profile: MinimumJerk or AsymmetricFitts (Linear is timed by the caller)
+ * @param duration_us Total duration for movement (microseconds)
+ * @param travelled Distance covered toward target (pixels)
+ * @param total Total distance to target (pixels)
+ *
+ * @return Scheduled time in microseconds, in range [0, duration_us]
+ */
+inline unsigned int velocity_profile_time_us(
+	VelocityProfile profile,
+	unsigned int duration_us,
+	unsigned short travelled,
+	unsigned short total
+) {
+	if (total == 0 || travelled >= total) return duration_us;
+
+	// Progress in 1/256 of a table interval
+	unsigned int position = (static_cast<unsigned int>(travelled) << (profileTableShift + 8)) / total;
+	unsigned int index = position >> 8;
+	unsigned int fraction = position & 0xFF;
+
+	const unsigned short* table = (profile == VelocityProfile::MinimumJerk)
+		? minimum_jerk_time_table
+		: asymmetric_fitts_time_table;
+	unsigned int lo = table[index];
+	unsigned int hi = table[index + 1];
+	unsigned int time_fraction = lo + (((hi - lo) * fraction) >> 8);
+
+	return static_cast<unsigned int>((static_cast<unsigned long long>(duration_us) * time_fraction) >> profileTimeShift);
+}
+
 /**
 	* @brief WindMouse with guaranteed: deltaX, deltaY final point reched + guaranteed duration for perfect sleep
 	*
@@ -218,6 +288,7 @@ auto fast_hypot(T x, T y) {
 	* @param gravity_strength Pull strength toward target
 	* @param max_wind_magnitude Maximum random jitter magnitude
 	* @param max_step_size Maximum velocity per step in
+	* @param velocity_profile Speed distribution along the path (time per step looked up by progress)
 	*
 	* @return iteration_count: Optional, #define WindMouseDebug required, void default
  */
@@ -234,7 +305,8 @@ wind_mouse_perfect(
 	SleepCallback sleepPerfect,
 	unsigned char gravity_strength = 10,
 	unsigned char max_wind_magnitude = 2,
-	unsigned char max_step_size = 32
+	unsigned char max_step_size = 32,
+	VelocityProfile velocity_profile = VelocityProfile::Linear
 )
 {
 	// gravity_strength      = Gravity constant       Pull toward goal
@@ -263,6 +335,12 @@ wind_mouse_perfect(
 	unsigned short total_distance = static_cast<unsigned short>(fast_hypot(delta_x, delta_y));
 	unsigned short distance_to_target = total_distance;
 
+	// Profile budget follows progress toward target, the rest is a floor proportional to step distance
+	unsigned int profile_budget_us = (velocity_profile == VelocityProfile::Linear)
+		? 0
+		: duration_remaining_us - (duration_remaining_us >> profileFloorShift);
+	unsigned int scheduled_us = 0;
+
 	while (true) {
 
 #ifdef WindMouseDebug
@@ -295,11 +373,26 @@ wind_mouse_perfect(
 			current_x += step_x;
 			current_y += step_y;
 
-			// Calculate timing for this step
+			// Calculate timing for this step: floor from time outside profile budget, every moving step gets time
 			unsigned short step_distance = static_cast<unsigned short>(fast_hypot(step_x, step_y));
-			unsigned int sleep_duration = (distance_to_target > 0)
-				? (duration_remaining_us * step_distance) / distance_to_target
-				: duration_remaining_us;
+			unsigned int floor_remaining_us = duration_remaining_us - (profile_budget_us - scheduled_us);
+			unsigned int floor_sleep = (distance_to_target > 0)
+				? (floor_remaining_us * step_distance) / distance_to_target
+				: floor_remaining_us;
+
+			// New distance to target
+			distance_to_target = static_cast<unsigned short>(fast_hypot(delta_x - current_x, delta_y - current_y));
+
+			// Profile time at new progress minus profile time already scheduled
+			unsigned int profile_sleep = 0;
+			if (velocity_profile != VelocityProfile::Linear) {
+				unsigned short travelled = (distance_to_target < total_distance) ? total_distance - distance_to_target : 0;
+				unsigned int target_time_us = velocity_profile_time_us(velocity_profile, profile_budget_us, travelled, total_distance);
+				profile_sleep = (target_time_us > scheduled_us) ? target_time_us - scheduled_us : 0;
+				scheduled_us += profile_sleep;
+			}
+
+			unsigned int sleep_duration = floor_sleep + profile_sleep;
 			duration_remaining_us -= sleep_duration;
 
 			// Execute movement
@@ -307,9 +400,6 @@ wind_mouse_perfect(
 
 			prev_x = current_x;
 			prev_y = current_y;
-
-			// New distance to target
-			distance_to_target = static_cast<unsigned short>(fast_hypot(delta_x - current_x, delta_y - current_y));
 		}
 		else {
 			// Final movement directly to target
@@ -341,6 +431,7 @@ wind_mouse_perfect(
 	* @param gravity_strength Pull strength toward target
 	* @param max_wind_magnitude Maximum random jitter magnitude
 	* @param max_step_size Maximum velocity per step in pixels
+	* @param velocity_profile Speed distribution along the path (time per step looked up by progress)
 	* 
 	* @return iteration_count: Optional, #define WindMouseDebug required, void default
  */
@@ -358,7 +449,8 @@ wind_mouse_imperfect(
 	GetTimeCallback getTime_us,
 	unsigned char gravity_strength = 10,
 	unsigned char max_wind_magnitude = 2,
-	unsigned char max_step_size = 32
+	unsigned char max_step_size = 32,
+	VelocityProfile velocity_profile = VelocityProfile::Linear
 )
 {
 	// gravity_strength      = Gravity constant       Pull toward goal
@@ -387,6 +479,12 @@ wind_mouse_imperfect(
 	unsigned long long start_time = getTime_us();
 	int accumulated_duration_error_us = 0;
 
+	// Profile budget follows progress toward target, the rest is a floor proportional to step distance
+	unsigned int profile_budget_us = (velocity_profile == VelocityProfile::Linear)
+		? 0
+		: duration_us - (duration_us >> profileFloorShift);
+	unsigned int scheduled_us = 0;
+
 	while (true) {
 #ifdef WindMouseDebug
 		iteration_count++;
@@ -412,11 +510,26 @@ wind_mouse_imperfect(
 			short step_y = static_cast<short>(velocity_y / scaleFactor);
 			current_x += step_x;
 			current_y += step_y;
-			// Calculate timing for this step
+			// Calculate timing for this step: floor from time outside profile budget, every moving step gets time
 			unsigned short step_distance = static_cast<unsigned short>(fast_hypot(step_x, step_y));
-			unsigned int ideal_sleep = (distance_to_target > 0)
-				? (duration_remaining_us * step_distance) / distance_to_target
-				: duration_remaining_us;
+			unsigned int profile_unspent_us = profile_budget_us - scheduled_us;
+			unsigned int floor_remaining_us = (duration_remaining_us > profile_unspent_us)
+				? (duration_remaining_us - profile_unspent_us)
+				: 0;
+			unsigned int floor_sleep = (distance_to_target > 0)
+				? (floor_remaining_us * step_distance) / distance_to_target
+				: floor_remaining_us;
+			// New distance to target
+			distance_to_target = static_cast<unsigned short>(fast_hypot(delta_x - current_x, delta_y - current_y));
+			// Profile time at new progress minus profile time already scheduled
+			unsigned int profile_sleep = 0;
+			if (velocity_profile != VelocityProfile::Linear) {
+				unsigned short travelled = (distance_to_target < total_distance) ? total_distance - distance_to_target : 0;
+				unsigned int target_time_us = velocity_profile_time_us(velocity_profile, profile_budget_us, travelled, total_distance);
+				profile_sleep = (target_time_us > scheduled_us) ? target_time_us - scheduled_us : 0;
+				scheduled_us += profile_sleep;
+			}
+			unsigned int ideal_sleep = floor_sleep + profile_sleep;
 
 			// Compensate for accumulated timing error
 			int compensated_sleep = static_cast<int>(ideal_sleep) - accumulated_duration_error_us;
@@ -442,9 +555,6 @@ wind_mouse_imperfect(
 
 			prev_x = current_x;
 			prev_y = current_y;
-
-			// New distance to target
-			distance_to_target = static_cast<unsigned short>(fast_hypot(delta_x - current_x, delta_y - current_y));
 		}
 		else {
 			interpolateMouseMoveImperfect(delta_x - prev_x, delta_y - prev_y, duration_remaining_us, moveDelta, sleepImperfect, getTime_us);
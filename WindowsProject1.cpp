@@ -129,6 +129,15 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
 				});
 		}
 
+		////WindMouse with asymmetric velocity profile (fast start, slow approach) and perfect sleep
+		//for (int i = 0; i < 10; ++i) {
+		//	g_mouseX = 0;
+		//	g_mouseY = 50 + i * 50;
+		//	MeasureTime([&]() {
+		//		return wind_mouse_perfect(800, 0, 1000 * 1000, moveCallback, sleepCallbackPercise, 10, 2, 32, VelocityProfile::AsymmetricFitts);
+		//		});
+		//}
+
 		////WindMouse and Linear Interpolation with chrono sleep
 		////!!!If sleep is imperfect it means we can't interpolate with 1 delta step, we need greater step to mach percision of sleep and timer
 		//for (int i = 0; i < 10; ++i) {